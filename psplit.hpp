@@ -35,6 +35,8 @@
 #include <vector>
 #include <string>
 #include <filesystem>
+#include <iterator>
+#include <cstddef>
 
 namespace psplit {
 
@@ -296,6 +298,126 @@ inline std::vector<std::string> split_lines_copy(std::string_view data) noexcept
     return lines;
 }
 
+// Finds the next line at or after `current` that contains `needle`. The
+// buffer is searched for the needle first and only the line surrounding
+// the hit is delimited, so non-matching lines are never split. Line
+// endings are handled exactly like in split_lines.
+inline bool next_matching_line(std::string_view data,
+                               std::string_view needle,
+                               size_t &current,
+                               std::string_view &line) noexcept {
+    std::string_view newlines("\r\n");
+    if(current >= data.size() || needle.find_first_of(newlines) != std::string_view::npos) {
+        current = data.size();
+        return false;
+    }
+    const auto hit = data.find(needle, current);
+    if(hit == std::string_view::npos) {
+        current = data.size();
+        return false;
+    }
+    auto begin = hit == 0 ? std::string_view::npos : data.find_last_of(newlines, hit - 1);
+    begin = begin == std::string_view::npos ? 0 : begin + 1;
+    auto end = data.find_first_of(newlines, hit + needle.size());
+    if(end == std::string_view::npos) {
+        end = data.size();
+    }
+    line = data.substr(begin, end - begin);
+
+    if(end == data.size()) {
+        current = end;
+    } else if(data[end] == '\r' && end + 1 < data.size() && data[end + 1] == '\n') {
+        current = end + 2;
+    } else {
+        current = end + 1;
+    }
+    return true;
+}
+
+class MatchingLines final {
+public:
+    class iterator final {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view *;
+        using reference = const std::string_view &;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept { return line; }
+        pointer operator->() const noexcept { return &line; }
+
+        iterator &operator++() noexcept {
+            advance();
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            auto old = *this;
+            advance();
+            return old;
+        }
+
+        bool operator==(const iterator &o) const noexcept {
+            return done == o.done && (done || current == o.current);
+        }
+        bool operator!=(const iterator &o) const noexcept { return !(*this == o); }
+
+    private:
+        friend class MatchingLines;
+        iterator(std::string_view data, std::string_view needle) noexcept
+            : data(data), needle(needle), done(false) {
+            advance();
+        }
+
+        void advance() noexcept { done = !next_matching_line(data, needle, current, line); }
+
+        std::string_view data;
+        std::string_view needle;
+        size_t current = 0;
+        std::string_view line;
+        bool done = true;
+    };
+
+    MatchingLines(std::string_view data, std::string_view needle) noexcept
+        : data(data), needle(needle) {}
+
+    iterator begin() const noexcept { return iterator(data, needle); }
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    std::string_view data;
+    std::string_view needle;
+};
+
+inline std::vector<std::string_view> split_lines_matching(std::string_view data,
+                                                          std::string_view needle) noexcept {
+    std::vector<std::string_view> lines;
+    std::string_view line;
+    size_t current = 0;
+    while(next_matching_line(data, needle, current, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+inline MatchingLines split_lines_matching_lazy(std::string_view data,
+                                               std::string_view needle) noexcept {
+    return MatchingLines(data, needle);
+}
+
+inline std::vector<std::string> split_lines_matching_copy(std::string_view data,
+                                                          std::string_view needle) noexcept {
+    std::vector<std::string> lines;
+    auto line_views = split_lines_matching(data, needle);
+    lines.reserve(line_views.size());
+    for(const auto &s : line_views) {
+        lines.emplace_back(s);
+    }
+    return lines;
+}
+
 inline std::vector<std::string> split_file_copy(const std::filesystem::path &path) noexcept {
     MmapFile mf(path);
     return split_lines_copy(mf.view());
@@ -261,6 +261,55 @@ int test_substr4() {
     return check_substring_splits(input, substr, truth_preserve, truth_drop);
 }
 
+int test_matching() {
+    std::string input1("foo\nbar\n\nbarfoo\nbaz\nfoo");
+    std::string input2("foo\r\nbar\r\n\r\nbarfoo\r\nbaz\r\nfoo");
+    const std::vector<std::string> truth{{"foo"}, {"barfoo"}, {"foo"}};
+
+    auto result = psplit::split_lines_matching_copy(input1, "foo");
+    if(validate(result, truth) != 0) {
+        return 1;
+    }
+    result = psplit::split_lines_matching_copy(input2, "foo");
+    if(validate(result, truth) != 0) {
+        return 1;
+    }
+    result.clear();
+    for(const auto &line : psplit::split_lines_matching_lazy(input2, "foo")) {
+        result.emplace_back(line);
+    }
+    return validate(result, truth);
+}
+
+int test_matching2() {
+    std::string input("one\r\n\ntwo\rthree\n");
+    const std::vector<std::string> truth_all{{"one"}, {""}, {"two"}, {"three"}};
+    const std::vector<std::string> truth_none{};
+
+    auto result = psplit::split_lines_matching_copy(input, "");
+    if(validate(result, truth_all) != 0) {
+        return 1;
+    }
+    result = psplit::split_lines_matching_copy(input, "e\r\nt");
+    if(validate(result, truth_none) != 0) {
+        return 1;
+    }
+    result = psplit::split_lines_matching_copy(input, "four");
+    if(validate(result, truth_none) != 0) {
+        return 1;
+    }
+    result = psplit::split_lines_matching_copy("", "");
+    return validate(result, truth_none);
+}
+
+int test_matching_file() {
+    psplit::MmapFile mf(DATADIR "input_dos.txt");
+    const std::vector<std::string> truth{{"def"}};
+
+    auto result = psplit::split_lines_matching_copy(mf.view(), "e");
+    return validate(result, truth);
+}
+
 int main() {
     std::cout << "Test 1\n";
     if(test1() != 0) {
@@ -348,5 +397,20 @@ int main() {
     if(test_substr4() != 0) {
         return 1;
     }
+
+    std::cout << "Test matching\n";
+    if(test_matching() != 0) {
+        return 1;
+    }
+
+    std::cout << "Test matching 2\n";
+    if(test_matching2() != 0) {
+        return 1;
+    }
+
+    std::cout << "Test matching file\n";
+    if(test_matching_file() != 0) {
+        return 1;
+    }
     return 0;
 }